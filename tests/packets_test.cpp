@@ -109,6 +109,24 @@ TEST(Data, Serialization) {
     EXPECT_EQ(Buffer.size(), PacketSize);
 }
 
+/// Test that Data packet with a negotiated blocksize (RFC 2348) larger than 512 bytes serializes completely
+TEST(Data, BlocksizeSerialization) {
+    std::vector<std::uint8_t> DataBuffer(1428);
+    for (std::size_t Idx = 0; Idx != DataBuffer.size(); ++Idx) {
+        DataBuffer[Idx] = static_cast<std::uint8_t>(Idx);
+    }
+    auto Packet = Data{1, DataBuffer};
+
+    std::vector<std::uint8_t> Buffer;
+    auto PacketSize = Packet.serialize(std::back_inserter(Buffer));
+    EXPECT_EQ(PacketSize, sizeof(std::uint16_t) + sizeof(std::uint16_t) + DataBuffer.size());
+
+    // data field
+    EXPECT_DATA(Buffer, 4, DataBuffer);
+
+    EXPECT_EQ(Buffer.size(), PacketSize);
+}
+
 /// Test that Acknowledgment packet serialization is going fine and everything is converting to network byte order
 TEST(Acknowledgment, Serialization) {
     auto Packet = Acknowledgment{255};
@@ -20,6 +20,7 @@ TEST(Request, Parse) {
     ASSERT_EQ(Packet.getType(), types::ReadRequest);
     ASSERT_EQ(Packet.getFilename(), "/srv/tftp/ReadFile");
     ASSERT_EQ(Packet.getMode(), "netascii");
+    ASSERT_EQ(Packet.getOptionsCount(), 0u);
 
     ASSERT_EQ(Res.isSuccess(), true);
     ASSERT_EQ(BytesRead, Length);
@@ -59,6 +60,7 @@ TEST(Request, OptionParse) {
 
     std::vector<std::string> OptionsNames = {"saveFiles", "discardQualifiers", "secret"};
     std::vector<std::string> OptionsValues = {"true", "false", "Ix0e86yG8YpFzwz1gS0XxJW3"};
+    ASSERT_EQ(Packet.getOptionsCount(), OptionsNames.size());
     for (std::size_t Idx = 0; Idx != OptionsNames.size(); ++Idx) {
         ASSERT_EQ(Packet.getOptionName(Idx), OptionsNames[Idx]);
         ASSERT_EQ(Packet.getOptionValue(Idx), OptionsValues[Idx]);
@@ -68,6 +70,52 @@ TEST(Request, OptionParse) {
     ASSERT_EQ(BytesRead, Length);
 }
 
+/// Test that Request packet with an unterminated field isn't parsed
+TEST(Request, TruncatedParse) {
+    std::uint8_t PacketBytes[] = {// type
+                                  0x00, 0x01,
+                                  // filename
+                                  0x69, 0x6d, 0x61, 0x67, 0x65, 0x00,
+                                  // mode (missing terminator)
+                                  0x6f, 0x63, 0x74, 0x65, 0x74};
+    auto Length = sizeof(PacketBytes) / sizeof(std::uint8_t);
+
+    auto Res = Parser<Request>::parse(PacketBytes, Length);
+    ASSERT_EQ(Res.isSuccess(), false);
+}
+
+/// Test that Request packet options can be looked up by name regardless of case
+TEST(Request, OptionLookup) {
+    std::uint8_t PacketBytes[] = {// type
+                                  0x00, 0x02,
+                                  // filename
+                                  0x69, 0x6d, 0x61, 0x67, 0x65, 0x00,
+                                  // mode
+                                  0x6f, 0x63, 0x74, 0x65, 0x74, 0x00,
+                                  // tsize option name
+                                  0x74, 0x73, 0x69, 0x7a, 0x65, 0x00,
+                                  // tsize option value
+                                  0x34, 0x30, 0x39, 0x36, 0x00,
+                                  // BLKSIZE option name
+                                  0x42, 0x4c, 0x4b, 0x53, 0x49, 0x5a, 0x45, 0x00,
+                                  // BLKSIZE option value
+                                  0x31, 0x34, 0x32, 0x38, 0x00};
+    auto Length = sizeof(PacketBytes) / sizeof(std::uint8_t);
+
+    auto Res = Parser<Request>::parse(PacketBytes, Length);
+    auto [Packet, BytesRead] = Res.get();
+
+    ASSERT_EQ(Packet.getType(), types::WriteRequest);
+    ASSERT_EQ(Packet.hasOption("tsize"), true);
+    ASSERT_EQ(Packet.getOptionValue("TSize"), "4096");
+    ASSERT_EQ(Packet.hasOption("blksize"), true);
+    ASSERT_EQ(Packet.getOptionValue("blksize"), "1428");
+    ASSERT_EQ(Packet.hasOption("timeout"), false);
+
+    ASSERT_EQ(Res.isSuccess(), true);
+    ASSERT_EQ(BytesRead, Length);
+}
+
 /// Test that Data packet parsing is going fine
 TEST(Data, Parse) {
     std::uint8_t PacketBytes[] = {// type
@@ -95,6 +143,25 @@ TEST(Data, Parse) {
     ASSERT_EQ(BytesRead, Length);
 }
 
+/// Test that Data packet with an empty data field (the last block of a transfer) parsing is going fine
+TEST(Data, EmptyParse) {
+    std::uint8_t PacketBytes[] = {// type
+                                  0x00, 0x03,
+                                  // block number
+                                  0x00, 0x02};
+    auto Length = sizeof(PacketBytes) / sizeof(std::uint8_t);
+
+    auto Res = Parser<Data>::parse(PacketBytes, Length);
+    auto [Packet, BytesRead] = Res.get();
+
+    ASSERT_EQ(Packet.getType(), types::DataPacket);
+    ASSERT_EQ(Packet.getBlock(), 0x02);
+    ASSERT_EQ(Packet.getData().empty(), true);
+
+    ASSERT_EQ(Res.isSuccess(), true);
+    ASSERT_EQ(BytesRead, Length);
+}
+
 /// Test that Acknowledgment packet parsing is going fine
 TEST(Acknowledgment, Parse) {
     std::uint8_t PacketBytes[] = {// type
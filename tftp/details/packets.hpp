@@ -7,6 +7,7 @@
 #endif
 
 #include <cassert>
+#include <cctype>
 #include <cstdint>
 #include <string>
 #include <string_view>
@@ -144,6 +145,9 @@ class Request final {
 
     std::string_view getMode() const noexcept { return std::string_view(Mode.data(), Mode.size()); }
 
+    /// @return Number of options (name and value pairs) in the request
+    std::size_t getOptionsCount() const noexcept { return OptionsNames.size(); }
+
     std::string_view getOptionName(std::size_t Idx) const noexcept {
         return std::string_view(OptionsNames[Idx].data(), OptionsNames[Idx].size());
     }
@@ -152,7 +156,37 @@ class Request final {
         return std::string_view(OptionsValues[Idx].data(), OptionsValues[Idx].size());
     }
 
+    /// Check if there's an option with the specified name (option names are case-insensitive, RFC 2347)
+    bool hasOption(std::string_view OptionName) const noexcept { return findOption(OptionName) != OptionsNames.size(); }
+
+    /// Get option value by its name (option names are case-insensitive, RFC 2347)
+    /// @param[OptionName] Assumptions: There's an option with the specified name
+    std::string_view getOptionValue(std::string_view OptionName) const noexcept {
+        auto Idx = findOption(OptionName);
+        assert(Idx != OptionsNames.size());
+        return getOptionValue(Idx);
+    }
+
   private:
+    /// @return Index of the option with the specified name or the number of options if there's no such option
+    std::size_t findOption(std::string_view OptionName) const noexcept {
+        for (std::size_t Idx = 0; Idx != OptionsNames.size(); ++Idx) {
+            const auto &Name = OptionsNames[Idx];
+            if (Name.size() != OptionName.size()) {
+                continue;
+            }
+            bool Equal = true;
+            for (std::size_t Pos = 0; Pos != Name.size() && Equal; ++Pos) {
+                Equal = std::tolower(static_cast<unsigned char>(Name[Pos])) ==
+                        std::tolower(static_cast<unsigned char>(OptionName[Pos]));
+            }
+            if (Equal) {
+                return Idx;
+            }
+        }
+        return OptionsNames.size();
+    }
+
     std::uint16_t Type_;
     std::string Filename;
     std::string Mode;
@@ -166,21 +200,21 @@ class Data final {
     /// Use with parsing functions only
     Data() = default;
     /// @param[Block] Assumptions: The \p Block value is greater than one
-    /// @param[Buffer] Assumptions: The \p Buffer size is greater or equal than 0 and less or equal than 512
+    /// @param[Buffer] Assumptions: The \p Buffer size is greater or equal than 0 and less or equal than 65464
     Data(std::uint16_t Block, const std::vector<std::uint8_t> &Buffer)
         : Block(Block), DataBuffer(Buffer.begin(), Buffer.end()) {
         // The block numbers on data packets begin with one and increase by one for each new block of data
         assert(Block >= 1);
-        // The data field is from zero to 512 bytes long
-        assert(Buffer.size() >= 0 && Buffer.size() <= 512);
+        // The data field is from zero to 512 bytes long, or up to the negotiated blocksize (RFC 2348)
+        assert(Buffer.size() >= 0 && Buffer.size() <= 65464);
     }
     /// @param[Block] Assumptions: The \p Block value is greater than one
-    /// @param[Buffer] Assumptions: The \p Buffer size is greater or equal than 0 and less or equal than 512
+    /// @param[Buffer] Assumptions: The \p Buffer size is greater or equal than 0 and less or equal than 65464
     Data(std::uint16_t Block, std::vector<std::uint8_t> &&Buffer) noexcept : Block(Block) {
         // The block numbers on data packets begin with one and increase by one for each new block of data
         assert(Block >= 1);
-        // The data field is from zero to 512 bytes long
-        assert(Buffer.size() >= 0 && Buffer.size() <= 512);
+        // The data field is from zero to 512 bytes long, or up to the negotiated blocksize (RFC 2348)
+        assert(Buffer.size() >= 0 && Buffer.size() <= 65464);
         this->DataBuffer = std::move(Buffer);
     }
 
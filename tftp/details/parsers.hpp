@@ -1,6 +1,7 @@
 #pragma once
 
 #include "packets.hpp"
+#include <cstring>
 #include <optional>
 #include <variant>
 
@@ -45,7 +46,22 @@ template <> struct Parser<Request> {
 
         std::size_t Step = 0;
         std::size_t BytesRead = 0;
-        for (std::size_t Idx = 0; Idx != Len; ++Idx) {
+        std::size_t Idx = 0;
+
+        // Read the null-terminated string starting at Idx in one go, leaving Idx at its terminator
+        auto ReadString = [&](std::string &Str) {
+            const auto *Begin = Buffer + Idx;
+            const auto *End = static_cast<const std::uint8_t *>(std::memchr(Begin, 0, Len - Idx));
+            if (End == nullptr) {
+                return false;
+            }
+            Str.assign(Begin, End);
+            BytesRead += End - Begin;
+            Idx += End - Begin;
+            return true;
+        };
+
+        for (; Idx != Len; ++Idx) {
             const auto Byte = Buffer[Idx];
             BytesRead++;
 
@@ -66,47 +82,43 @@ template <> struct Parser<Request> {
                 break;
             // Filename
             case 2:
-                if (Byte == 0u) {
-                    Step++;
-                } else {
-                    Filename.push_back(Byte);
+                if (!ReadString(Filename)) {
+                    return {std::nullopt};
                 }
+                Step++;
                 break;
             // Mode
             case 3:
-                if (Byte == 0u) {
-                    if (Idx == Len - 1) {
-                        return ParseResult<Request>{Request{(types::Type)Type_, std::move(Filename), std::move(Mode)},
-                                                    BytesRead};
-                    }
-                    Step++;
-                } else {
-                    Mode.push_back(Byte);
+                if (!ReadString(Mode)) {
+                    return {std::nullopt};
                 }
+                if (Idx == Len - 1) {
+                    return ParseResult<Request>{Request{(types::Type)Type_, std::move(Filename), std::move(Mode)},
+                                                BytesRead};
+                }
+                Step++;
                 break;
             // Option name
             case 4:
-                if (Byte == 0u) {
-                    OptionsNames.push_back(std::move(Name));
-                    Step++;
-                } else {
-                    Name.push_back(Byte);
+                if (!ReadString(Name)) {
+                    return {std::nullopt};
                 }
+                OptionsNames.push_back(std::move(Name));
+                Step++;
                 break;
             // Option value
             case 5:
-                if (Byte == 0u) {
-                    OptionsValues.push_back(std::move(Value));
+                if (!ReadString(Value)) {
+                    return {std::nullopt};
+                }
+                OptionsValues.push_back(std::move(Value));
 
-                    if (Idx == Len - 1) {
-                        return ParseResult<Request>{Request{(types::Type)Type_, std::move(Filename), std::move(Mode),
-                                                            std::move(OptionsNames), std::move(OptionsValues)},
-                                                    BytesRead};
-                    }
-                    Step--;
-                } else {
-                    Value.push_back(Byte);
+                if (Idx == Len - 1) {
+                    return ParseResult<Request>{Request{(types::Type)Type_, std::move(Filename), std::move(Mode),
+                                                        std::move(OptionsNames), std::move(OptionsValues)},
+                                                BytesRead};
                 }
+                Step--;
                 break;
             default:
                 assert(false);
@@ -127,7 +139,6 @@ template <> struct Parser<Data> {
 
         std::uint16_t Type_;
         std::uint16_t Block;
-        std::vector<std::uint8_t> DataBuffer;
 
         std::size_t Step = 0;
         std::size_t BytesRead = 0;
@@ -155,20 +166,14 @@ template <> struct Parser<Data> {
                 Block = std::uint16_t(Byte) << 0;
                 Step++;
                 break;
-            case 3:
+            case 3: {
                 Block |= std::uint16_t(Byte) << 8;
                 Block = ntohs(Block);
-                Step++;
-                break;
-            // buffer
-            case 4:
-                DataBuffer.push_back(Byte);
-
-                if (Idx == Len - 1) {
-                    return ParseResult<Data>{Data{Block, std::move(DataBuffer)}, BytesRead};
-                }
-
-                break;
+                // buffer (the rest of the packet, possibly empty), copied in one go
+                std::vector<std::uint8_t> DataBuffer(Buffer + Idx + 1, Buffer + Len);
+                BytesRead += DataBuffer.size();
+                return ParseResult<Data>{Data{Block, std::move(DataBuffer)}, BytesRead};
+            }
             default:
                 assert(false);
             }